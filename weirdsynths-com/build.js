@@ -0,0 +1,205 @@
+// Storefront build — pre-renders the catalog into static HTML
+//
+// Usage: node build.js   (run by Netlify, output in dist/)
+//
+// index.html and success.html are page templates:
+//   <!-- @product-grid -->            rendered module cards from catalog.js
+//   {{PLUGIN_PRICE}} {{LIFETIME_PRICE}}  base USD prices from catalog.js
+//   {{MODULES_JSON}}                  module names and plugin files by ID
+// Every other file in this directory, except the BUILD_INPUTS and
+// PRIVATE_DIRS below, is copied to dist/ unchanged.
+// Plugin files live in downloads/, which is never published; the
+// downloads function serves them after checking the entitlement token.
+// The build fails if a page links a local file that did not end up in
+// dist/, unless it is one of the EXTERNAL_PAGES.
+// CSS above the "BELOW THE FOLD" marker stays inline as critical CSS. The
+// rest of the CSS and the page script are written to content-hashed files
+// under dist/assets/, which netlify.toml serves as immutable.
+//
+// Regional prices are written to dist/prices/<country>.json, and a
+// _redirects file maps GET /api/prices to the visitor's country at the
+// CDN edge, so the storefront never waits on a function cold start.
+//
+const crypto = require('crypto');
+const fs = require('fs');
+const path = require('path');
+
+const {
+  PRODUCTS,
+  PLUGIN_PRICE_USD,
+  LIFETIME_PRICE_USD,
+  REGIONAL_PRICING,
+  getPrices,
+} = require('./catalog');
+
+const SRC = __dirname;
+const OUT = path.join(SRC, 'dist');
+const ASSETS = path.join(OUT, 'assets');
+const TEMPLATES = ['index.html', 'success.html'];
+const BUILD_INPUTS = new Set([
+  ...TEMPLATES, 'build.js', 'catalog.js', 'entitlements.js', 'stripe-client.js', 'netlify.toml',
+  'package.json', 'package-lock.json', 'netlify', 'node_modules', 'dist',
+]);
+const PRIVATE_DIRS = new Set(['downloads']);
+// Demo pages linked from index.html that are uploaded to the site
+// separately and are not part of this directory
+const EXTERNAL_PAGES = new Set(['face-cv-navigator.html', 'face-cv-midi-bridge.html']);
+// The downloads function returns files base64-encoded (+33%) under a 6 MB
+// response limit, leaving headroom for headers
+const MAX_DOWNLOAD_BYTES = 4.5 * 1000 * 1000;
+const FOLD_MARKER = '/* ═══ BELOW THE FOLD ═══ */';
+
+const TOKENS = {
+  PLUGIN_PRICE: PLUGIN_PRICE_USD / 100,
+  LIFETIME_PRICE: LIFETIME_PRICE_USD / 100,
+  MODULES_JSON: JSON.stringify(
+    Object.fromEntries(PRODUCTS.map(p => [p.id, { name: p.name, file: p.file, free: p.badge === 'free' }])),
+  ).replace(/</g, '\\u003c'),
+};
+
+function escapeHtml(str) {
+  return String(str)
+    .replace(/&/g, '&amp;')
+    .replace(/</g, '&lt;')
+    .replace(/>/g, '&gt;')
+    .replace(/"/g, '&quot;');
+}
+
+// ── PRODUCT GRID ────────────────────────────────────────────
+function renderCard(p) {
+  const badge = p.badge
+    ? `<span class="card-badge ${p.badgeClass}">${escapeHtml(p.badge)}</span>`
+    : '';
+  const tags = p.tags.map(t => `<span>${escapeHtml(t)}</span>`).join('');
+  return `
+    <div class="product-card animate-in">
+      <div class="card-image" style="background:linear-gradient(135deg,${p.gradient})">
+        <span class="module-visual">${p.icon}</span>
+        ${badge}
+      </div>
+      <div class="card-body">
+        <h3>${escapeHtml(p.name)}</h3>
+        <div class="card-desc">${escapeHtml(p.desc)}</div>
+        <div class="card-tags">${tags}</div>
+        <div class="card-footer">
+          <span class="card-included">${p.badge === 'free' ? '✓ Always Free' : '✓ Included in Plugin'}</span>
+        </div>
+      </div>
+    </div>`;
+}
+
+// ── HASHED ASSETS ───────────────────────────────────────────
+function writeAsset(name, ext, content) {
+  const hash = crypto.createHash('sha256').update(content).digest('hex').slice(0, 10);
+  const file = `${name}.${hash}.${ext}`;
+  fs.writeFileSync(path.join(ASSETS, file), content);
+  return `/assets/${file}`;
+}
+
+// ── REGIONAL PRICES ─────────────────────────────────────────
+function writePrices() {
+  const dir = path.join(OUT, 'prices');
+  fs.mkdirSync(dir, { recursive: true });
+
+  const rules = [];
+  for (const country of Object.keys(REGIONAL_PRICING)) {
+    fs.writeFileSync(path.join(dir, `${country}.json`), JSON.stringify(getPrices(country)));
+    rules.push(`/api/prices  /prices/${country}.json  200  Country=${country.toLowerCase()}`);
+  }
+  fs.writeFileSync(path.join(dir, 'default.json'), JSON.stringify(getPrices(null)));
+  rules.push('/api/prices  /prices/default.json  200');
+
+  // _redirects rules run before the /api/* function rule in netlify.toml
+  fs.writeFileSync(path.join(OUT, '_redirects'), rules.join('\n') + '\n');
+  return rules.length - 1;
+}
+
+// ── STATIC FILES ────────────────────────────────────────────
+function copySite() {
+  for (const entry of fs.readdirSync(SRC)) {
+    if (BUILD_INPUTS.has(entry) || PRIVATE_DIRS.has(entry) || entry.startsWith('.')) continue;
+    fs.cpSync(path.join(SRC, entry), path.join(OUT, entry), { recursive: true });
+  }
+}
+
+// Local href/src targets in built pages must exist in dist/
+function checkLinks() {
+  const missing = [];
+  for (const page of fs.readdirSync(OUT).filter(f => f.endsWith('.html'))) {
+    const html = fs.readFileSync(path.join(OUT, page), 'utf8');
+    for (const [, url] of html.matchAll(/(?:href|src)="([^"]+)"/g)) {
+      if (/^([a-z]+:|\/\/|#)/i.test(url) || url.includes('${')) continue;
+      const target = url.split(/[?#]/)[0].replace(/^\//, '');
+      if (!target || target.startsWith('api/') || EXTERNAL_PAGES.has(target)) continue;
+      if (!fs.existsSync(path.join(OUT, target))) missing.push(`${page} → ${url}`);
+    }
+  }
+  if (missing.length) throw new Error(`Linked files missing from dist/:\n  ${missing.join('\n  ')}`);
+}
+
+// Plugin files in downloads/ must fit in one downloads function response
+function checkDownloads() {
+  const tooLarge = [];
+  for (const { file } of PRODUCTS) {
+    const src = path.join(SRC, 'downloads', file);
+    if (!fs.existsSync(src)) {
+      console.warn(`downloads/${file} not found — its download will 404`);
+      continue;
+    }
+    const { size } = fs.statSync(src);
+    if (size > MAX_DOWNLOAD_BYTES) tooLarge.push(`${file} (${(size / 1e6).toFixed(1)} MB)`);
+  }
+  if (tooLarge.length) {
+    throw new Error(`Downloads over ${MAX_DOWNLOAD_BYTES / 1e6} MB:\n  ${tooLarge.join('\n  ')}`);
+  }
+}
+
+function renderTokens(html, file) {
+  return html.replace(/\{\{(\w+)\}\}/g, (match, key) => {
+    if (!(key in TOKENS)) throw new Error(`${file}: unknown token ${match}`);
+    return String(TOKENS[key]);
+  });
+}
+
+function extractOne(html, re, what) {
+  const matches = html.match(new RegExp(re.source, 'g')) || [];
+  if (matches.length !== 1) throw new Error(`index.html: expected one ${what}, found ${matches.length}`);
+  return html.match(re);
+}
+
+function build() {
+  fs.rmSync(OUT, { recursive: true, force: true });
+  fs.mkdirSync(ASSETS, { recursive: true });
+
+  let html = fs.readFileSync(path.join(SRC, 'index.html'), 'utf8');
+
+  html = html.replace('<!-- @product-grid -->', () => PRODUCTS.map(renderCard).join('') + '\n  ');
+  html = renderTokens(html, 'index.html');
+
+  // Critical CSS stays inline, the rest loads without blocking render
+  const [styleTag, css] = extractOne(html, /<style>([\s\S]*?)<\/style>/, '<style> block');
+  const fold = css.indexOf(FOLD_MARKER);
+  if (fold < 0) throw new Error('index.html: missing BELOW THE FOLD marker');
+  const cssUrl = writeAsset('site', 'css', css.slice(fold).trim() + '\n');
+  html = html.replace(styleTag, () =>
+    `<style>${css.slice(0, fold).trimEnd()}\n</style>\n` +
+    `<link rel="stylesheet" href="${cssUrl}" media="print" onload="this.media='all'">\n` +
+    `<noscript><link rel="stylesheet" href="${cssUrl}"></noscript>`);
+
+  const [scriptTag, js] = extractOne(html, /<script>([\s\S]*?)<\/script>/, '<script> block');
+  const jsUrl = writeAsset('site', 'js', js.trim() + '\n');
+  html = html.replace(scriptTag, () => `<script src="${jsUrl}" defer></script>`);
+
+  fs.writeFileSync(path.join(OUT, 'index.html'), html);
+  const success = fs.readFileSync(path.join(SRC, 'success.html'), 'utf8');
+  fs.writeFileSync(path.join(OUT, 'success.html'), renderTokens(success, 'success.html'));
+
+  copySite();
+  const regions = writePrices();
+  checkLinks();
+  checkDownloads();
+
+  console.log(`Built ${PRODUCTS.length} modules, ${regions} price regions → dist/ (${path.basename(cssUrl)}, ${path.basename(jsUrl)})`);
+}
+
+build();
@@ -0,0 +1,106 @@
+// WeirdSynths catalog — single source for modules and pricing
+//
+// Read by build.js (pre-renders the store pages) and by the Netlify
+// functions (checkout sessions, purchase verification).
+//
+
+// ── MODULES (all included in plugin) ────────────────────────
+const PRODUCTS = [
+  { id:'face-cv', name:'Face-CV Navigator', icon:'👁', badge:'popular', badgeClass:'badge-popular',
+    desc:'Real-time face tracking to CV. 468 landmarks, 8-emotion engine, velocity/momentum camera model. Your face becomes a modulation source.',
+    tags:['Face Tracking','CV','Emotion','MediaPipe'], gradient:'#0a1628,#0d0d20',
+    file:'WeirdSynths-FaceCV.vcvplugin' },
+  { id:'iris', name:'IRIS', icon:'🌀', badge:'new', badgeClass:'badge-new',
+    desc:'Spectral morphing oscillator with 4D wavetable navigation. Traverse timbral hyperspace with CV control over the W axis.',
+    tags:['Oscillator','Spectral','4D','Wavetable'], gradient:'#180a28,#0d0d20',
+    file:'WeirdSynths-IRIS.vcvplugin' },
+  { id:'emotionlfo', name:'EmotionLFO', icon:'🎭', badge:null,
+    desc:'8-channel LFO driven by facial emotion classification. Joy speeds up, sadness slows down, anger adds chaos.',
+    tags:['LFO','Emotion','Generative','8-ch'], gradient:'#0a2818,#0d0d20',
+    file:'WeirdSynths-EmotionLFO.vcvplugin' },
+  { id:'penrose', name:'PenroseEngine', icon:'🔮', badge:null,
+    desc:'Non-Euclidean delay network. Signal paths curve through hyperbolic space. Feedback that physically cannot exist in flat geometry.',
+    tags:['Delay','Non-Euclidean','Feedback','Spatial'], gradient:'#28180a,#0d0d20',
+    file:'WeirdSynths-PenroseEngine.vcvplugin' },
+  { id:'void', name:'VoidReverb', icon:'🕳', badge:null,
+    desc:'Reverb with negative space. Inverted rooms, Klein bottle reflections, tesseract chambers.',
+    tags:['Reverb','Spatial','Impossible'], gradient:'#0a1828,#0d0d20',
+    file:'WeirdSynths-VoidReverb.vcvplugin' },
+  { id:'geofilter', name:'GeoFilter', icon:'🌊', badge:null,
+    desc:'Filter whose topology changes with CV. Morph between ladder, SVF, comb, and formant — actually warping the circuit geometry.',
+    tags:['Filter','Morphing','Topology'], gradient:'#1a0a28,#0d0d20',
+    file:'WeirdSynths-GeoFilter.vcvplugin' },
+  { id:'portal', name:'PortalMixer', icon:'🔀', badge:null,
+    desc:'8-channel mixer where channels pass through spatial portals. Pan position wraps through non-Euclidean space.',
+    tags:['Mixer','Spatial','8-ch','Portal'], gradient:'#0a2020,#0d0d20',
+    file:'WeirdSynths-PortalMixer.vcvplugin' },
+  { id:'ossuary', name:'OSSUARY', icon:'💀', badge:'free', badgeClass:'badge-free',
+    desc:'Bone-resonance physical modeler. Simulates acoustic properties of skeletal structures. Eerie, organic timbres.',
+    tags:['Physical Model','Organic','Free'], gradient:'#10100a,#0d0d20',
+    file:'WeirdSynths-OSSUARY.vcvplugin' },
+];
+
+const ALL_MODULES = PRODUCTS.map(p => p.id);
+const FREE_MODULES = PRODUCTS.filter(p => p.badge === 'free').map(p => p.id);
+
+// ── BASE PRICES (USD cents) ─────────────────────────────────
+const PLUGIN_PRICE_USD  = 5000;   // $50
+const LIFETIME_PRICE_USD = 25600; // $256
+
+// ── REGIONAL PRICING (purchasing power parity) ──────────────
+// Multipliers relative to USD — lower = cheaper for that region
+const REGIONAL_PRICING = {
+  // Latin America
+  BR: 0.40, MX: 0.50, AR: 0.30, CL: 0.50, CO: 0.40, PE: 0.40,
+  // South/Southeast Asia
+  IN: 0.30, PH: 0.35, ID: 0.30, VN: 0.30, TH: 0.40, MY: 0.45,
+  // Eastern Europe
+  PL: 0.55, RO: 0.45, HU: 0.50, CZ: 0.55, BG: 0.40, UA: 0.30,
+  // Turkey / Middle East
+  TR: 0.35, EG: 0.30, SA: 0.70, AE: 0.80,
+  // Africa
+  ZA: 0.40, NG: 0.30, KE: 0.30, GH: 0.30,
+  // East Asia (lower cost)
+  CN: 0.50, KR: 0.65, TW: 0.65,
+  // Western Europe (near parity)
+  GB: 0.90, DE: 0.90, FR: 0.90, NL: 0.90, SE: 0.90, NO: 0.90,
+  ES: 0.85, IT: 0.85, PT: 0.75, GR: 0.70,
+  // Oceania
+  AU: 0.85, NZ: 0.80,
+  // North America
+  US: 1.00, CA: 0.85,
+  // Japan
+  JP: 0.75,
+  // Russia / CIS
+  RU: 0.35, KZ: 0.35,
+};
+
+function getRegionalPrice(basePriceUSD, countryCode) {
+  const multiplier = REGIONAL_PRICING[countryCode] || 1.0;
+  // Round to nearest 100 cents ($1 increments) for clean display
+  return Math.max(100, Math.round((basePriceUSD * multiplier) / 100) * 100);
+}
+
+// Price payload the storefront shows — country is null when unknown.
+// Only listed countries with a discount count as regional, so the static
+// default.json and the checkout.js fallback agree for unlisted ones.
+function getPrices(countryCode) {
+  const multiplier = REGIONAL_PRICING[countryCode];
+  return {
+    country: countryCode,
+    plugin: getRegionalPrice(PLUGIN_PRICE_USD, countryCode),
+    lifetime: getRegionalPrice(LIFETIME_PRICE_USD, countryCode),
+    isRegional: multiplier !== undefined && multiplier < 1,
+  };
+}
+
+module.exports = {
+  PRODUCTS,
+  ALL_MODULES,
+  FREE_MODULES,
+  PLUGIN_PRICE_USD,
+  LIFETIME_PRICE_USD,
+  REGIONAL_PRICING,
+  getRegionalPrice,
+  getPrices,
+};
@@ -0,0 +1,90 @@
+// Entitlements — what a paid checkout session unlocks
+//
+// A verified session is turned into a short-lived signed token
+// (HMAC-SHA256 over session ID, modules, plan and expiry). Refreshes of
+// success.html and every /downloads/ request are checked locally against
+// it with no Stripe call.
+// The Stripe webhook records paid sessions in the 'entitlements' blob
+// store, so even the first visit rarely needs Stripe.
+//
+// Environment variables (set in Netlify dashboard):
+//   ENTITLEMENT_SECRET — HMAC key for entitlement tokens
+//
+const crypto = require('crypto');
+const { ALL_MODULES } = require('./catalog');
+
+const TOKEN_TTL_SECONDS = 60 * 60; // 1 hour
+
+// ── SESSION → ENTITLEMENT ───────────────────────────────────
+function entitlementFromSession(session) {
+  if (session.payment_status !== 'paid') return null;
+
+  const sessionPlan = session.metadata?.plan;
+  let modules = [];
+  let plan = null;
+
+  if (sessionPlan === 'plugin-suite' || sessionPlan === 'lifetime-access') {
+    modules = ALL_MODULES;
+    plan = sessionPlan;
+  } else {
+    const items = session.metadata?.items;
+    if (items) modules = items.split(',');
+  }
+
+  modules = modules.filter(id => ALL_MODULES.includes(id));
+  return { modules, plan, customer_email: session.customer_details?.email };
+}
+
+// ── SIGNED TOKENS ───────────────────────────────────────────
+function sign(payload) {
+  return crypto.createHmac('sha256', process.env.ENTITLEMENT_SECRET)
+    .update(payload)
+    .digest('base64url');
+}
+
+// Throws when no signing key is configured — paid downloads can't work without one
+function issueToken(sessionId, { modules, plan }) {
+  if (!process.env.ENTITLEMENT_SECRET) throw new Error('ENTITLEMENT_SECRET not set');
+  const exp = Math.floor(Date.now() / 1000) + TOKEN_TTL_SECONDS;
+  const payload = Buffer.from(JSON.stringify({ s: sessionId, m: modules, p: plan, exp })).toString('base64url');
+  return { token: `${payload}.${sign(payload)}`, expires: exp };
+}
+
+// Returns { sessionId, modules, plan, expires } for a valid, unexpired token, else null
+function verifyToken(token) {
+  if (!process.env.ENTITLEMENT_SECRET || typeof token !== 'string') return null;
+
+  const [payload, sig] = token.split('.');
+  if (!payload || !sig) return null;
+
+  const expected = Buffer.from(sign(payload));
+  const actual = Buffer.from(sig);
+  if (actual.length !== expected.length || !crypto.timingSafeEqual(actual, expected)) return null;
+
+  try {
+    const { s, m, p, exp } = JSON.parse(Buffer.from(payload, 'base64url').toString());
+    if (typeof s !== 'string' || !Array.isArray(m) || !(exp > Date.now() / 1000)) return null;
+    return {
+      sessionId: s,
+      modules: m.filter(id => ALL_MODULES.includes(id)),
+      plan: p ?? null,
+      expires: exp,
+    };
+  } catch (e) {
+    return null;
+  }
+}
+
+// ── ENTITLEMENT STORE (Netlify Blobs, keyed by session ID) ──
+function getEntitlementStore(event) {
+  const { connectLambda, getStore } = require('@netlify/blobs');
+  connectLambda(event);
+  return getStore('entitlements');
+}
+
+module.exports = {
+  entitlementFromSession,
+  issueToken,
+  verifyToken,
+  getEntitlementStore,
+};
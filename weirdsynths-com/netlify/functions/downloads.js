@@ -0,0 +1,53 @@
+// Plugin Downloads — serves /downloads/<file> to entitlement holders
+//
+// Free modules are served to anyone. Paid modules need ?token= from
+// verify-session, checked locally (no Stripe call) and required to list
+// the module. Files come from downloads/, bundled with this function via
+// included_files in netlify.toml and never published as static assets.
+// Responses are base64 bodies and the 6 MB function response limit
+// applies to the encoded body, so each file must stay under about
+// 4.5 MB. build.js fails on larger files (MAX_DOWNLOAD_BYTES).
+//
+const fs = require('fs');
+const path = require('path');
+const { PRODUCTS, FREE_MODULES } = require('../../catalog');
+const { verifyToken } = require('../../entitlements');
+
+const DOWNLOAD_DIR = path.resolve(__dirname, '../../downloads');
+
+exports.handler = async (event) => {
+  if (event.httpMethod !== 'GET') {
+    return { statusCode: 405, body: JSON.stringify({ error: 'Method not allowed' }) };
+  }
+
+  // Only catalog file names are served — no path from the request reaches fs
+  const product = PRODUCTS.find(p => p.file === path.basename(event.path));
+  if (!product) return { statusCode: 404, body: JSON.stringify({ error: 'Unknown download' }) };
+
+  if (!FREE_MODULES.includes(product.id)) {
+    const granted = verifyToken(event.queryStringParameters?.token);
+    if (!granted) {
+      return { statusCode: 401, body: JSON.stringify({ error: 'Download link expired — reopen your purchase page' }) };
+    }
+    if (!granted.modules.includes(product.id)) {
+      return { statusCode: 403, body: JSON.stringify({ error: 'Module not included in your purchase' }) };
+    }
+  }
+
+  try {
+    const file = fs.readFileSync(path.join(DOWNLOAD_DIR, product.file));
+    return {
+      statusCode: 200,
+      headers: {
+        'Content-Type': 'application/octet-stream',
+        'Content-Disposition': `attachment; filename="${product.file}"`,
+        'Cache-Control': 'private, no-store',
+      },
+      body: file.toString('base64'),
+      isBase64Encoded: true,
+    };
+  } catch (error) {
+    console.error('Download error:', error);
+    return { statusCode: 404, body: JSON.stringify({ error: 'File not available' }) };
+  }
+};
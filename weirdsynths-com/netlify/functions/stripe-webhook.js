@@ -0,0 +1,48 @@
+// Stripe Webhook — records paid checkout sessions as entitlements
+//
+// Environment variables (set in Netlify dashboard):
+//   STRIPE_SECRET_KEY     — Stripe secret key
+//   STRIPE_WEBHOOK_SECRET — signing secret for this webhook endpoint
+//
+// Subscribe the endpoint (/api/stripe-webhook) to
+// checkout.session.completed and checkout.session.async_payment_succeeded.
+//
+const { getStripe } = require('../../stripe-client');
+const { entitlementFromSession, getEntitlementStore } = require('../../entitlements');
+
+const HANDLED_EVENTS = ['checkout.session.completed', 'checkout.session.async_payment_succeeded'];
+
+exports.handler = async (event) => {
+  if (event.httpMethod !== 'POST') {
+    return { statusCode: 405, body: JSON.stringify({ error: 'Method not allowed' }) };
+  }
+
+  let stripeEvent;
+  try {
+    const rawBody = event.isBase64Encoded ? Buffer.from(event.body, 'base64') : event.body;
+    stripeEvent = getStripe().webhooks.constructEvent(
+      rawBody,
+      event.headers['stripe-signature'],
+      process.env.STRIPE_WEBHOOK_SECRET,
+    );
+  } catch (error) {
+    return { statusCode: 400, body: JSON.stringify({ error: 'Invalid signature' }) };
+  }
+
+  if (!HANDLED_EVENTS.includes(stripeEvent.type)) {
+    return { statusCode: 200, body: JSON.stringify({ received: true }) };
+  }
+
+  try {
+    const session = stripeEvent.data.object;
+    const entitlement = entitlementFromSession(session);
+    // Async payment methods complete unpaid; the later succeeded event records them
+    if (entitlement) await getEntitlementStore(event).setJSON(session.id, entitlement);
+
+    return { statusCode: 200, body: JSON.stringify({ received: true }) };
+  } catch (error) {
+    console.error('Webhook error:', error);
+    // Non-2xx makes Stripe retry the delivery
+    return { statusCode: 500, body: JSON.stringify({ error: 'Could not record entitlement' }) };
+  }
+};
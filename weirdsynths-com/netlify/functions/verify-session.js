@@ -1,39 +1,69 @@
 // Verify Stripe Session — returns purchased module IDs
-const stripe = require('stripe')(process.env.STRIPE_SECRET_KEY);
-const ALL_MODULES = ['face-cv','iris','emotionlfo','penrose','void','geofilter','portal','ossuary'];
+//
+// Accepts { session_id } plus an optional { token } from an earlier
+// verification. A valid token issued for the same session is checked
+// locally; otherwise the session is looked up in the webhook-filled
+// entitlement store and only then in Stripe. Every success returns a
+// fresh entitlement token.
+//
+const {
+  entitlementFromSession,
+  issueToken,
+  verifyToken,
+  getEntitlementStore,
+} = require('../../entitlements');
+const { getStripe } = require('../../stripe-client');
+
+async function lookupSession(event, sessionId) {
+  let store = null;
+  try {
+    store = getEntitlementStore(event);
+    const cached = await store.get(sessionId, { type: 'json' });
+    if (cached) return cached;
+  } catch (e) {
+    console.error('Entitlement store unavailable:', e.message);
+  }
+
+  const session = await getStripe().checkout.sessions.retrieve(sessionId);
+  const entitlement = entitlementFromSession(session);
+  if (entitlement && store) {
+    // Webhook may not have landed yet — record it so the next lookup is local
+    await store.setJSON(sessionId, entitlement).catch(() => {});
+  }
+  return entitlement;
+}
 
 exports.handler = async (event) => {
   if (event.httpMethod !== 'POST') {
     return { statusCode: 405, body: JSON.stringify({ error: 'Method not allowed' }) };
   }
   try {
-    const { session_id } = JSON.parse(event.body);
+    const { session_id, token } = JSON.parse(event.body);
+
     if (!session_id) return { statusCode: 400, body: JSON.stringify({ error: 'No session ID' }) };
 
-    const session = await stripe.checkout.sessions.retrieve(session_id);
-    if (session.payment_status !== 'paid') {
-      return { statusCode: 402, body: JSON.stringify({ error: 'Payment not completed' }) };
+    const granted = verifyToken(token);
+    if (granted && granted.sessionId === session_id) {
+      const { modules, plan } = granted;
+      return {
+        statusCode: 200,
+        body: JSON.stringify({ modules, plan, ...issueToken(session_id, granted) }),
+      };
     }
 
-    const sessionPlan = session.metadata?.plan;
-    let modules = [];
-    let plan = null;
-
-    if (sessionPlan === 'plugin-suite' || sessionPlan === 'lifetime-access') {
-      modules = ALL_MODULES;
-      plan = sessionPlan;
-    } else {
-      const items = session.metadata?.items;
-      if (items) modules = items.split(',');
+    const entitlement = await lookupSession(event, session_id);
+    if (!entitlement) {
+      return { statusCode: 402, body: JSON.stringify({ error: 'Payment not completed' }) };
     }
 
-    modules = modules.filter(id => ALL_MODULES.includes(id));
-
+    // Same shape as the token path above — no customer_email, which tokens don't carry
+    const { modules, plan } = entitlement;
     return {
       statusCode: 200,
-      body: JSON.stringify({ modules, plan, customer_email: session.customer_details?.email }),
+      body: JSON.stringify({ modules, plan, ...issueToken(session_id, entitlement) }),
     };
   } catch (error) {
+    console.error('Verify session error:', error);
     return { statusCode: 500, body: JSON.stringify({ error: 'Could not verify session' }) };
   }
 };
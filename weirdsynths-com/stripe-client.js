@@ -0,0 +1,16 @@
+// Stripe client — shared by the Netlify functions
+//
+// The SDK is loaded on first use, so paths that never talk to Stripe
+// (price lookups, token checks) don't pay for it on a cold start.
+//
+// Environment variables (set in Netlify dashboard):
+//   STRIPE_SECRET_KEY — Stripe secret key
+//
+let stripeClient = null;
+
+function getStripe() {
+  if (!stripeClient) stripeClient = require('stripe')(process.env.STRIPE_SECRET_KEY);
+  return stripeClient;
+}
+
+module.exports = { getStripe };